@@ -1097,6 +1097,54 @@ typedef enum _sai_acl_table_attr_t
      */
     SAI_ACL_TABLE_ATTR_AVAILABLE_ACL_COUNTER,
 
+    /**
+     * @brief Compile ACL entries before programming
+     *
+     * The adapter optimizes the entries of the table before programming
+     * them to HW: fully shadowed entries are not programmed, entries with
+     * the same priority and actions that differ only in adjacent IP
+     * prefixes or L4 port ranges are merged, and entries of equal priority
+     * are reordered for packing. Reordering is limited to entries of equal
+     * priority which do not overlap or which have identical actions, since
+     * overlapping entries of equal priority are resolved by insertion
+     * order. Entries with a counter, policer or mirror action are never
+     * merged or removed. Matching behavior is the same as without
+     * compilation, which the adapter verifies before replacing the
+     * programmed entries; if verification fails the entries are programmed
+     * uncompiled.
+     *
+     * Compilation never delays create, remove or set of an ACL entry: the
+     * entry change is in effect in HW when the call returns
+     * #SAI_STATUS_SUCCESS, programmed incrementally as without compilation.
+     * The adapter recompiles the affected entries in the background and
+     * swaps the result in atomically, so a single entry change does not
+     * recompile the whole table in the calling thread.
+     *
+     * @type bool
+     * @flags CREATE_ONLY
+     * @default false
+     */
+    SAI_ACL_TABLE_ATTR_COMPILE_ENABLE,
+
+    /**
+     * @brief Number of HW entries the table entries take without compilation
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_ACL_TABLE_ATTR_UNCOMPILED_HW_ENTRY_COUNT,
+
+    /**
+     * @brief Number of HW entries the table entries take
+     *
+     * Equal to #SAI_ACL_TABLE_ATTR_UNCOMPILED_HW_ENTRY_COUNT when
+     * #SAI_ACL_TABLE_ATTR_COMPILE_ENABLE is false.
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_ACL_TABLE_ATTR_HW_ENTRY_COUNT,
+
     /**
      * @brief End of ACL Table attributes
      */
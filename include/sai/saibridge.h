@@ -260,6 +260,41 @@ typedef enum _sai_bridge_port_attr_t
      */
     SAI_BRIDGE_PORT_ATTR_ISOLATION_GROUP,
 
+    /**
+     * @brief Dynamic FDB entry aging time in seconds for entries on this bridge port
+     *
+     * Only effective when #SAI_SWITCH_ATTR_FDB_AGING_MODE is
+     * SAI_SWITCH_FDB_AGING_MODE_SOFTWARE. Default for entries on this bridge
+     * port which do not set #SAI_FDB_ENTRY_ATTR_AGING_TIME. Zero means the
+     * switch wide #SAI_SWITCH_ATTR_FDB_AGING_TIME applies. Use
+     * #SAI_BRIDGE_PORT_ATTR_FDB_AGING_ENABLE to disable aging on this
+     * bridge port.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_BRIDGE_PORT_ATTR_FDB_AGING_TIME,
+
+    /**
+     * @brief Enable aging of dynamic FDB entries on this bridge port
+     *
+     * Default for dynamic FDB entries on this bridge port whose
+     * #SAI_FDB_ENTRY_ATTR_AGING is SAI_FDB_ENTRY_AGING_DEFAULT. When
+     * disabled, such entries never age out, regardless of
+     * #SAI_BRIDGE_PORT_ATTR_FDB_AGING_TIME and #SAI_SWITCH_ATTR_FDB_AGING_TIME,
+     * e.g. on a tunnel bridge port carrying only EVPN learned entries. To
+     * exempt individual entries on a bridge port which also carries locally
+     * learned entries, such as MCLAG synced entries, use
+     * #SAI_FDB_ENTRY_ATTR_AGING instead. Only effective when
+     * #SAI_SWITCH_ATTR_FDB_AGING_MODE is SAI_SWITCH_FDB_AGING_MODE_SOFTWARE.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default true
+     */
+    SAI_BRIDGE_PORT_ATTR_FDB_AGING_ENABLE,
+
     /**
      * @brief End of attributes
      */
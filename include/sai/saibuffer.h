@@ -595,6 +595,12 @@ typedef enum _sai_buffer_profile_attr_t
      * @brief Dynamic threshold for the shared usage
      *
      * The threshold is set to the 2^n of available buffer of the pool.
+     * A PG or queue using this profile may occupy shared buffer as long as
+     * its shared usage is below 2^n * (pool shared buffer size - total
+     * shared usage of the pool), e.g. n = 0 for alpha 1, n = -1 for alpha
+     * 1/2. The threshold is evaluated per packet, so N congested buffers
+     * of equal alpha settle at alpha / (1 + N * alpha) of the shared buffer
+     * each.
      *
      * @type sai_int8_t
      * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
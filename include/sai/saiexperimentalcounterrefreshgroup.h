@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saiexperimentalcounterrefreshgroup.h
+ *
+ * @brief   This module defines SAI counter refresh group extension interface
+ */
+
+#if !defined (__SAIEXPERIMENTALCOUNTERREFRESHGROUP_H_)
+#define __SAIEXPERIMENTALCOUNTERREFRESHGROUP_H_
+
+#include <saitypes.h>
+
+/**
+ * @defgroup SAIEXPERIMENTALCOUNTERREFRESHGROUP SAI - Counter refresh group specific API definitions
+ *
+ * @{
+ */
+
+/**
+ * @brief Attribute Id for counter refresh group
+ *
+ * A counter refresh group overrides #SAI_SWITCH_ATTR_COUNTER_REFRESH_INTERVAL
+ * for a set of counters of one object type. Counters not covered by any
+ * group are refreshed at the switch wide interval. The adapter spreads the
+ * HW reads of a group evenly across its interval instead of reading all
+ * objects back to back.
+ */
+typedef enum _sai_counter_refresh_group_attr_t
+{
+    /**
+     * @brief Start of attributes
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_START,
+
+    /**
+     * @brief Object type of the counters
+     *
+     * @type sai_object_type_t
+     * @flags MANDATORY_ON_CREATE | CREATE_ONLY
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_OBJECT_TYPE = SAI_COUNTER_REFRESH_GROUP_ATTR_START,
+
+    /**
+     * @brief Counter ids in the group
+     *
+     * Counter ids of #SAI_COUNTER_REFRESH_GROUP_ATTR_OBJECT_TYPE, e.g.
+     * sai_queue_stat_t for queues. A counter id can be member of only one
+     * group. Empty list selects all counters of the object type which are
+     * not member of another group. Only one group per object type may have
+     * an empty list, creating a second one or setting the list of a second
+     * one to empty fails with #SAI_STATUS_INVALID_ATTR_VALUE.
+     *
+     * @type sai_u32_list_t
+     * @flags CREATE_AND_SET
+     * @default empty
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_STAT_LIST,
+
+    /**
+     * @brief Refresh interval in milliseconds
+     *
+     * @type sai_uint32_t
+     * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_INTERVAL,
+
+    /**
+     * @brief Adapt refresh interval to observed change rate
+     *
+     * Counters which did not change over consecutive refreshes are
+     * refreshed less often, up to #SAI_COUNTER_REFRESH_GROUP_ATTR_MAX_INTERVAL.
+     * A counter which changes returns to #SAI_COUNTER_REFRESH_GROUP_ATTR_INTERVAL.
+     *
+     * @type bool
+     * @flags CREATE_ONLY
+     * @default false
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_ADAPTIVE_ENABLE,
+
+    /**
+     * @brief Maximum adaptive refresh interval in milliseconds
+     *
+     * @type sai_uint32_t
+     * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
+     * @condition SAI_COUNTER_REFRESH_GROUP_ATTR_ADAPTIVE_ENABLE == true
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_MAX_INTERVAL,
+
+    /**
+     * @brief Average refresh interval in milliseconds currently applied
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_CURRENT_INTERVAL,
+
+    /**
+     * @brief Counter history duration in seconds
+     *
+     * Every refresh of the group is appended to the in memory counter
+     * history, compressed with delta of delta timestamps and XOR encoded
+     * values, and kept for the given duration, within the memory budget
+     * #SAI_SWITCH_ATTR_COUNTER_HISTORY_MEMORY_SIZE. History is read with
+     * get_counter_refresh_group_stats_history(). Value 0 disables history
+     * for the group.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_HISTORY_DURATION,
+
+    /**
+     * @brief Histogram bin upper boundaries
+     *
+     * Ascending list of N boundaries defining N + 1 bins; every refresh
+     * increments the bin of the sampled value for each (object, counter)
+     * of the group. Watermark counters (e.g. #SAI_QUEUE_STAT_WATERMARK_BYTES,
+     * #SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES) are read
+     * and cleared in HW on every refresh so each sample is the peak of that
+     * interval, while the adapter keeps the watermark since the last user
+     * read for get stats calls. Histograms are read with
+     * get_counter_refresh_group_stats_histogram(). Empty list disables
+     * histograms.
+     *
+     * Histograms are only kept for watermark and current occupancy counters
+     * (e.g. #SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES). Setting a non empty list
+     * on a group whose #SAI_COUNTER_REFRESH_GROUP_ATTR_STAT_LIST is empty or
+     * contains other counters, or setting such a list on a group with
+     * histograms, fails with #SAI_STATUS_INVALID_ATTR_VALUE. Adaptive refresh
+     * (#SAI_COUNTER_REFRESH_GROUP_ATTR_ADAPTIVE_ENABLE) does not apply to a
+     * group with histograms, so that every sample covers the same interval.
+     *
+     * @type sai_u32_list_t
+     * @flags CREATE_AND_SET
+     * @default empty
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_HISTOGRAM_BOUNDARY_LIST,
+
+    /**
+     * @brief End of attributes
+     */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_END,
+
+    /** Custom range base value */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_CUSTOM_RANGE_START = 0x10000000,
+
+    /** End of custom range base */
+    SAI_COUNTER_REFRESH_GROUP_ATTR_CUSTOM_RANGE_END
+
+} sai_counter_refresh_group_attr_t;
+
+/**
+ * @brief Create counter refresh group
+ *
+ * @param[out] counter_refresh_group_id Counter refresh group id
+ * @param[in] switch_id Switch id
+ * @param[in] attr_count Number of attributes
+ * @param[in] attr_list Array of attributes
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_create_counter_refresh_group_fn)(
+        _Out_ sai_object_id_t *counter_refresh_group_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list);
+
+/**
+ * @brief Remove counter refresh group
+ *
+ * @param[in] counter_refresh_group_id Counter refresh group id
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_remove_counter_refresh_group_fn)(
+        _In_ sai_object_id_t counter_refresh_group_id);
+
+/**
+ * @brief Set counter refresh group attribute
+ *
+ * @param[in] counter_refresh_group_id Counter refresh group id
+ * @param[in] attr Attribute
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_set_counter_refresh_group_attribute_fn)(
+        _In_ sai_object_id_t counter_refresh_group_id,
+        _In_ const sai_attribute_t *attr);
+
+/**
+ * @brief Get counter refresh group attribute
+ *
+ * @param[in] counter_refresh_group_id Counter refresh group id
+ * @param[in] attr_count Number of attributes
+ * @param[inout] attr_list Array of attributes
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_get_counter_refresh_group_attribute_fn)(
+        _In_ sai_object_id_t counter_refresh_group_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list);
+
+/**
+ * @brief Get counter history of an object
+ *
+ * Returns the samples of one counter kept by the counter history (see
+ * #SAI_COUNTER_REFRESH_GROUP_ATTR_HISTORY_DURATION) with timestamps in
+ * the range [start, end], oldest first.
+ *
+ * @param[in] switch_id Switch id
+ * @param[in] object_id Object id
+ * @param[in] counter_id Counter id
+ * @param[in] start Start of time range
+ * @param[in] end End of time range
+ * @param[inout] sample_count Number of samples
+ * @param[out] timestamps Array of sample timestamps
+ * @param[out] counters Array of sample values
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_BUFFER_OVERFLOW if list size insufficient, failure status code on error
+ */
+typedef sai_status_t (*sai_get_counter_refresh_group_stats_history_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t object_id,
+        _In_ sai_stat_id_t counter_id,
+        _In_ const sai_timespec_t *start,
+        _In_ const sai_timespec_t *end,
+        _Inout_ uint32_t *sample_count,
+        _Out_ sai_timespec_t *timestamps,
+        _Out_ uint64_t *counters);
+
+/**
+ * @brief Get counter histograms of multiple objects
+ *
+ * Returns the histograms kept for one counter (see
+ * #SAI_COUNTER_REFRESH_GROUP_ATTR_HISTOGRAM_BOUNDARY_LIST) of every
+ * object in the list, densely packed: bins[i * bin_count + j] is bin j
+ * of object_id[i].
+ *
+ * @param[in] switch_id Switch id
+ * @param[in] object_count Number of objects
+ * @param[in] object_id List of object ids
+ * @param[in] counter_id Counter id
+ * @param[in] mode Statistics mode, #SAI_STATS_MODE_READ or #SAI_STATS_MODE_READ_AND_CLEAR
+ * @param[inout] bin_count Number of bins per object
+ * @param[out] bins Array of bin sample counts
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_BUFFER_OVERFLOW if list size insufficient, failure status code on error
+ */
+typedef sai_status_t (*sai_get_counter_refresh_group_stats_histogram_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_stat_id_t counter_id,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ uint32_t *bin_count,
+        _Out_ uint64_t *bins);
+
+/**
+ * @brief Counter refresh group methods table retrieved with sai_api_query()
+ */
+typedef struct _sai_counter_refresh_group_api_t
+{
+    sai_create_counter_refresh_group_fn              create_counter_refresh_group;
+    sai_remove_counter_refresh_group_fn              remove_counter_refresh_group;
+    sai_set_counter_refresh_group_attribute_fn       set_counter_refresh_group_attribute;
+    sai_get_counter_refresh_group_attribute_fn       get_counter_refresh_group_attribute;
+    sai_get_counter_refresh_group_stats_history_fn   get_counter_refresh_group_stats_history;
+    sai_get_counter_refresh_group_stats_histogram_fn get_counter_refresh_group_stats_histogram;
+
+} sai_counter_refresh_group_api_t;
+
+/**
+ * @}
+ */
+#endif /** __SAIEXPERIMENTALCOUNTERREFRESHGROUP_H_ */
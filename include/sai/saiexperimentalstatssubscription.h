@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saiexperimentalstatssubscription.h
+ *
+ * @brief   This module defines SAI statistics subscription extension interface
+ */
+
+#if !defined (__SAIEXPERIMENTALSTATSSUBSCRIPTION_H_)
+#define __SAIEXPERIMENTALSTATSSUBSCRIPTION_H_
+
+#include <saitypes.h>
+
+/**
+ * @defgroup SAIEXPERIMENTALSTATSSUBSCRIPTION SAI - Statistics subscription specific API definitions
+ *
+ * @{
+ */
+
+/**
+ * @brief Statistics subscription ring record
+ *
+ * The subscription ring has the layout described for
+ * sai_switch_notification_ring_header_t. Every ring record starts with
+ * sai_switch_notification_ring_record_t, with count 1 and length
+ * sizeof(sai_stats_subscription_record_t), followed by one
+ * sai_stats_subscription_record_t.
+ */
+typedef struct _sai_stats_subscription_record_t
+{
+    /** Time the counter was read from hardware */
+    sai_timespec_t timestamp;
+
+    /**
+     * @brief Object id
+     *
+     * @objects SAI_OBJECT_TYPE_PORT
+     */
+    sai_object_id_t object_id;
+
+    /** Counter id */
+    sai_stat_id_t stat_id;
+
+    /** Reserved, set to zero */
+    uint32_t reserved;
+
+    /** Current counter value */
+    uint64_t value;
+
+    /**
+     * @brief Change since the previous record of the same counter
+     *
+     * Computed modulo the counter width, so a counter wrapping around is
+     * reported with the correct positive delta. The first record of a
+     * counter, after create or after the object or counter id was added to
+     * the subscription, carries delta 0 and is always emitted, so that the
+     * consumer starts from a known value.
+     */
+    uint64_t delta;
+
+} sai_stats_subscription_record_t;
+
+/**
+ * @brief Attribute Id for statistics subscription
+ */
+typedef enum _sai_stats_subscription_attr_t
+{
+    /**
+     * @brief Start of attributes
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_START,
+
+    /**
+     * @brief Ports whose counters are streamed
+     *
+     * @type sai_object_list_t
+     * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
+     * @objects SAI_OBJECT_TYPE_PORT
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_OBJECT_LIST = SAI_STATS_SUBSCRIPTION_ATTR_START,
+
+    /**
+     * @brief Counter ids streamed for every object
+     *
+     * Counter ids are sai_port_stat_t values.
+     *
+     * @type sai_u32_list_t
+     * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_STAT_LIST,
+
+    /**
+     * @brief Push interval in milliseconds
+     *
+     * Counter values are taken from the SW counter cache
+     * (#SAI_SWITCH_ATTR_COUNTER_REFRESH_INTERVAL), so the effective interval
+     * is never shorter than the cache refresh interval.
+     *
+     * @type sai_uint32_t
+     * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_INTERVAL,
+
+    /**
+     * @brief Only emit records for counters which changed
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default true
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_CHANGED_ONLY,
+
+    /**
+     * @brief Name of POSIX shared memory object holding the ring
+     *
+     * String is NULL terminated.
+     *
+     * @type sai_s8_list_t
+     * @flags MANDATORY_ON_CREATE | CREATE_ONLY
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_RING_NAME,
+
+    /**
+     * @brief Number of records in the ring
+     *
+     * Must be a power of two.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_ONLY
+     * @default 65536
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_RING_RECORD_COUNT,
+
+    /**
+     * @brief Wake up event file descriptor
+     *
+     * Signaled once after all records of one interval are published.
+     *
+     * @type sai_int32_t
+     * @flags READ_ONLY
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_EVENTFD,
+
+    /**
+     * @brief End of attributes
+     */
+    SAI_STATS_SUBSCRIPTION_ATTR_END,
+
+    /** Custom range base value */
+    SAI_STATS_SUBSCRIPTION_ATTR_CUSTOM_RANGE_START = 0x10000000,
+
+    /** End of custom range base */
+    SAI_STATS_SUBSCRIPTION_ATTR_CUSTOM_RANGE_END
+
+} sai_stats_subscription_attr_t;
+
+/**
+ * @brief Create statistics subscription
+ *
+ * @param[out] stats_subscription_id Statistics subscription id
+ * @param[in] switch_id Switch id
+ * @param[in] attr_count Number of attributes
+ * @param[in] attr_list Array of attributes
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_create_stats_subscription_fn)(
+        _Out_ sai_object_id_t *stats_subscription_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list);
+
+/**
+ * @brief Remove statistics subscription
+ *
+ * @param[in] stats_subscription_id Statistics subscription id
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_remove_stats_subscription_fn)(
+        _In_ sai_object_id_t stats_subscription_id);
+
+/**
+ * @brief Set statistics subscription attribute
+ *
+ * @param[in] stats_subscription_id Statistics subscription id
+ * @param[in] attr Attribute
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_set_stats_subscription_attribute_fn)(
+        _In_ sai_object_id_t stats_subscription_id,
+        _In_ const sai_attribute_t *attr);
+
+/**
+ * @brief Get statistics subscription attribute
+ *
+ * @param[in] stats_subscription_id Statistics subscription id
+ * @param[in] attr_count Number of attributes
+ * @param[inout] attr_list Array of attributes
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_get_stats_subscription_attribute_fn)(
+        _In_ sai_object_id_t stats_subscription_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list);
+
+/**
+ * @brief Statistics subscription methods table retrieved with sai_api_query()
+ */
+typedef struct _sai_stats_subscription_api_t
+{
+    sai_create_stats_subscription_fn        create_stats_subscription;
+    sai_remove_stats_subscription_fn        remove_stats_subscription;
+    sai_set_stats_subscription_attribute_fn set_stats_subscription_attribute;
+    sai_get_stats_subscription_attribute_fn get_stats_subscription_attribute;
+
+} sai_stats_subscription_api_t;
+
+/**
+ * @}
+ */
+#endif /** __SAIEXPERIMENTALSTATSSUBSCRIPTION_H_ */
@@ -33,6 +33,8 @@
 
 /* new experimental object type includes */
 #include "saiexperimentalbmtor.h"
+#include "saiexperimentalstatssubscription.h"
+#include "saiexperimentalcounterrefreshgroup.h"
 
 /**
  * @brief Extensions to SAI APIs
@@ -45,6 +47,10 @@ typedef enum _sai_api_extensions_t
 
     SAI_API_BMTOR = SAI_API_EXTENSIONS_RANGE_START,
 
+    SAI_API_STATS_SUBSCRIPTION,
+
+    SAI_API_COUNTER_REFRESH_GROUP,
+
     /* Add new experimental APIs above this line */
 
     SAI_API_EXTENSIONS_RANGE_START_END
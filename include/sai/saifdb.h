@@ -46,6 +46,22 @@ typedef enum _sai_fdb_entry_type_t
 
 } sai_fdb_entry_type_t;
 
+/**
+ * @brief Attribute data for #SAI_FDB_ENTRY_ATTR_AGING
+ */
+typedef enum _sai_fdb_entry_aging_t
+{
+    /** Aging follows #SAI_BRIDGE_PORT_ATTR_FDB_AGING_ENABLE of the bridge port */
+    SAI_FDB_ENTRY_AGING_DEFAULT,
+
+    /** Entry ages out */
+    SAI_FDB_ENTRY_AGING_ENABLED,
+
+    /** Entry never ages out */
+    SAI_FDB_ENTRY_AGING_DISABLED,
+
+} sai_fdb_entry_aging_t;
+
 /**
  * @brief FDB entry key
  */
@@ -87,6 +103,17 @@ typedef enum _sai_fdb_event_t
     /** FDB entry flushed */
     SAI_FDB_EVENT_FLUSHED,
 
+    /**
+     * @brief FDB entry move events suppressed
+     *
+     * Reported once when the move penalty of the entry crosses
+     * #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_SUPPRESS_THRESHOLD. Further moves
+     * are not reported until the penalty decays below
+     * #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_REUSE_THRESHOLD, at which point a
+     * single SAI_FDB_EVENT_MOVE with the current bridge port is reported.
+     */
+    SAI_FDB_EVENT_MOVE_SUPPRESSED,
+
 } sai_fdb_event_t;
 
 /**
@@ -178,6 +205,34 @@ typedef enum _sai_fdb_entry_attr_t
      */
     SAI_FDB_ENTRY_ATTR_COUNTER_ID,
 
+    /**
+     * @brief Aging of dynamic FDB entry
+     *
+     * Allows the control plane to exempt individual dynamic entries from
+     * aging, e.g. entries synced from an MCLAG peer which share the MCLAG
+     * bridge port with locally learned entries. Only effective for dynamic
+     * entries when #SAI_SWITCH_ATTR_FDB_AGING_MODE is
+     * SAI_SWITCH_FDB_AGING_MODE_SOFTWARE.
+     *
+     * @type sai_fdb_entry_aging_t
+     * @flags CREATE_AND_SET
+     * @default SAI_FDB_ENTRY_AGING_DEFAULT
+     */
+    SAI_FDB_ENTRY_ATTR_AGING,
+
+    /**
+     * @brief Aging time in seconds of dynamic FDB entry
+     *
+     * Zero means #SAI_BRIDGE_PORT_ATTR_FDB_AGING_TIME of the bridge port
+     * applies. Only effective under the same conditions as
+     * #SAI_FDB_ENTRY_ATTR_AGING.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_FDB_ENTRY_ATTR_AGING_TIME,
+
     /**
      * @brief End of attributes
      */
@@ -225,6 +280,8 @@ typedef enum _sai_fdb_flush_entry_type_t
  *    and #SAI_FDB_FLUSH_ATTR_BV_ID
  * 5) Flush all static entries by bridge port and VLAN - Set #SAI_FDB_FLUSH_ATTR_ENTRY_TYPE,
  *    #SAI_FDB_FLUSH_ATTR_BRIDGE_PORT_ID, and #SAI_FDB_FLUSH_ATTR_BV_ID
+ * 6) Flush all entries of an OUI on a bridge port - Set #SAI_FDB_FLUSH_ATTR_BRIDGE_PORT_ID,
+ *    #SAI_FDB_FLUSH_ATTR_MAC_ADDRESS and #SAI_FDB_FLUSH_ATTR_MAC_ADDRESS_MASK = ff:ff:ff:00:00:00
  */
 typedef enum _sai_fdb_flush_attr_t
 {
@@ -264,6 +321,46 @@ typedef enum _sai_fdb_flush_attr_t
      */
     SAI_FDB_FLUSH_ATTR_ENTRY_TYPE,
 
+    /**
+     * @brief Flush based on MAC address
+     *
+     * Entry matches when its MAC address AND #SAI_FDB_FLUSH_ATTR_MAC_ADDRESS_MASK
+     * equals this value AND the mask.
+     *
+     * @type sai_mac_t
+     * @flags CREATE_ONLY
+     * @default 00:00:00:00:00:00
+     */
+    SAI_FDB_FLUSH_ATTR_MAC_ADDRESS,
+
+    /**
+     * @brief MAC address mask for #SAI_FDB_FLUSH_ATTR_MAC_ADDRESS
+     *
+     * All zero mask matches any MAC address. A flush with a non zero mask
+     * always reports the flushed entries one by one as with
+     * #SAI_FDB_FLUSH_ATTR_NOTIFY_FLUSHED_ENTRIES set, since the consolidated
+     * flush event can not express the MAC filter.
+     *
+     * @type sai_mac_t
+     * @flags CREATE_ONLY
+     * @default 00:00:00:00:00:00
+     */
+    SAI_FDB_FLUSH_ATTR_MAC_ADDRESS_MASK,
+
+    /**
+     * @brief Report every flushed entry in FDB event notification
+     *
+     * When set, instead of the consolidated flush event described for
+     * sai_fdb_event_notification_data_t, adapter reports every flushed entry
+     * with SAI_FDB_EVENT_FLUSHED and its bridge port, delivered in as few
+     * notification calls as possible.
+     *
+     * @type bool
+     * @flags CREATE_ONLY
+     * @default false
+     */
+    SAI_FDB_FLUSH_ATTR_NOTIFY_FLUSHED_ENTRIES,
+
     /**
      * @brief End of attributes
      */
@@ -289,6 +386,9 @@ typedef enum _sai_fdb_flush_attr_t
  * consolidated event notification which will indicate that FDB flush operation
  * was performed.
  *
+ * Consolidated flush event is never sent for a flush with a non zero
+ * SAI_FDB_FLUSH_ATTR_MAC_ADDRESS_MASK, see that attribute.
+ *
  * Consolidated flush event will:
  *
  * Set data.fdb_entry.mac_address to 00:00:00:00:00:00.
@@ -333,6 +433,53 @@ typedef struct _sai_fdb_event_notification_data_t
 
 } sai_fdb_event_notification_data_t;
 
+/**
+ * @brief FDB snapshot entry flags
+ *
+ * @flags Contains flags
+ */
+typedef enum _sai_fdb_snapshot_entry_flag_t
+{
+    /** Entry was hit since its hit bit was last cleared */
+    SAI_FDB_SNAPSHOT_ENTRY_FLAG_HIT = 1 << 0,
+
+    /** Entry move events are suppressed by MAC move dampening */
+    SAI_FDB_SNAPSHOT_ENTRY_FLAG_MOVE_SUPPRESSED = 1 << 1,
+
+} sai_fdb_snapshot_entry_flag_t;
+
+/**
+ * @brief Packed FDB table snapshot record
+ *
+ * Switch id is implied by the snapshot call.
+ */
+typedef struct _sai_fdb_snapshot_entry_t
+{
+    /**
+     * @brief Bridge ID. for .1D and Vlan ID for .1Q
+     *
+     * @objects SAI_OBJECT_TYPE_BRIDGE, SAI_OBJECT_TYPE_VLAN
+     */
+    sai_object_id_t bv_id;
+
+    /**
+     * @brief Bridge port id
+     *
+     * @objects SAI_OBJECT_TYPE_BRIDGE_PORT
+     */
+    sai_object_id_t bridge_port_id;
+
+    /** MAC address */
+    sai_mac_t mac_address;
+
+    /** Bitmap of sai_fdb_snapshot_entry_flag_t */
+    uint16_t flags;
+
+    /** FDB entry type */
+    sai_fdb_entry_type_t type;
+
+} sai_fdb_snapshot_entry_t;
+
 /**
  * @brief Create FDB entry
  *
@@ -397,6 +544,96 @@ typedef sai_status_t (*sai_flush_fdb_entries_fn)(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list);
 
+/**
+ * @brief Remove all FDB entries by attribute set in sai_fdb_flush_attr and
+ * return the removed entries
+ *
+ * Matching entries are removed in a single walk of the FDB table and their
+ * keys are returned in fdb_entry_list. If fdb_entry_list is not large enough
+ * to hold all matching entries, no entry is removed, fdb_entry_count is set
+ * to the number of matching entries and #SAI_STATUS_BUFFER_OVERFLOW is
+ * returned.
+ *
+ * No FDB event notification is sent for the removed entries, regardless of
+ * #SAI_FDB_FLUSH_ATTR_NOTIFY_FLUSHED_ENTRIES, since the caller receives them
+ * in fdb_entry_list.
+ *
+ * @param[in] switch_id Switch object id
+ * @param[in] attr_count Number of attributes
+ * @param[in] attr_list Array of attributes
+ * @param[inout] fdb_entry_count Size of fdb_entry_list on input, number of
+ * removed entries on output
+ * @param[out] fdb_entry_list List of removed FDB entries
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_BUFFER_OVERFLOW if list
+ * size insufficient, failure status code on error
+ */
+typedef sai_status_t (*sai_flush_fdb_entries_ext_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Inout_ uint32_t *fdb_entry_count,
+        _Out_ sai_fdb_entry_t *fdb_entry_list);
+
+/**
+ * @brief Check whether FDB entries can be installed
+ *
+ * Predicts the result of installing the given entries, in list order, from
+ * the adapter software shadow of the FDB table without accessing hardware.
+ * The shadow follows the actual insert algorithm of the device, including
+ * the relocation of existing entries between buckets (cuckoo moves) that the
+ * hardware or SDK performs on insert, up to its move depth. An entry is
+ * reported as #SAI_STATUS_TABLE_FULL only if no placement exists within
+ * those relocations, which can happen even if
+ * #SAI_SWITCH_ATTR_AVAILABLE_FDB_ENTRY is non zero. Relocations predicted
+ * for an entry are applied to the shadow copy used for the rest of the
+ * list, and entries earlier in the list are assumed to be installed when
+ * checking later ones. No entry is installed by this call.
+ *
+ * @param[in] object_count Number of objects to check
+ * @param[in] fdb_entry List of FDB entries to check
+ * @param[out] object_statuses List of predicted statuses for every object:
+ * #SAI_STATUS_SUCCESS, #SAI_STATUS_TABLE_FULL or
+ * #SAI_STATUS_ITEM_ALREADY_EXISTS. Caller needs to allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS when all objects are predicted to install or
+ * #SAI_STATUS_FAILURE when any of the objects is predicted to fail
+ */
+typedef sai_status_t (*sai_bulk_check_fdb_entry_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Get snapshot of the FDB table
+ *
+ * Copies the whole FDB table in one sequential pass (DMA where supported)
+ * into entry_list. The API lock is not held for the duration of the copy, so
+ * other calls and learning proceed concurrently. generation is set to the
+ * value of #SAI_SWITCH_ATTR_FDB_GENERATION at the start of the copy, the
+ * snapshot is consistent if the attribute still has this value after the
+ * call returns.
+ *
+ * If entry_list is not large enough, entry_count is set to the number of
+ * entries in the table at the start of the copy, no entry of entry_list is
+ * guaranteed to be filled and #SAI_STATUS_BUFFER_OVERFLOW is returned. Since
+ * the table may grow before the retry, caller should allocate some headroom
+ * above the returned count.
+ *
+ * @param[in] switch_id Switch object id
+ * @param[inout] entry_count Size of entry_list on input, number of entries on output
+ * @param[out] entry_list List of FDB entries
+ * @param[out] generation FDB table generation number of the snapshot
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_BUFFER_OVERFLOW if list
+ * size insufficient, failure status code on error
+ */
+typedef sai_status_t (*sai_get_fdb_snapshot_fn)(
+        _In_ sai_object_id_t switch_id,
+        _Inout_ uint32_t *entry_count,
+        _Out_ sai_fdb_snapshot_entry_t *entry_list,
+        _Out_ uint64_t *generation);
+
 /**
  * @brief FDB notifications
  *
@@ -419,6 +656,9 @@ typedef struct _sai_fdb_api_t
     sai_set_fdb_entry_attribute_fn              set_fdb_entry_attribute;
     sai_get_fdb_entry_attribute_fn              get_fdb_entry_attribute;
     sai_flush_fdb_entries_fn                    flush_fdb_entries;
+    sai_flush_fdb_entries_ext_fn                flush_fdb_entries_ext;
+    sai_bulk_check_fdb_entry_fn                 check_fdb_entries;
+    sai_get_fdb_snapshot_fn                     get_fdb_snapshot;
 
 } sai_fdb_api_t;
 
@@ -85,6 +85,11 @@ typedef enum _sai_neighbor_entry_attr_t
      * Typical use-case is to set this true for neighbor with IPv6 link-local
      * addresses.
      *
+     * When false, the host route (/32 or /128 in the router interface
+     * virtual router) is installed by the neighbor create as part of the same
+     * hardware update, so a separate route entry for the neighbor address
+     * should not be created.
+     *
      * @type bool
      * @flags CREATE_AND_SET
      * @default false
@@ -217,16 +222,153 @@ typedef sai_status_t (*sai_get_neighbor_entry_attribute_fn)(
 typedef sai_status_t (*sai_remove_all_neighbor_entries_fn)(
         _In_ sai_object_id_t switch_id);
 
+/**
+ * @brief Bulk create neighbor entry
+ *
+ * Every entry is programmed together with its host route unless
+ * #SAI_NEIGHBOR_ENTRY_ATTR_NO_HOST_ROUTE is set for it, in the same way as
+ * for sai_create_neighbor_entry_fn.
+ *
+ * Note: IP address expected in Network Byte Order.
+ *
+ * @param[in] object_count Number of objects to create
+ * @param[in] neighbor_entry List of object to create
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to create.
+ * @param[in] attr_list List of attributes for every object.
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are created or
+ * #SAI_STATUS_FAILURE when any of the objects fails to create. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_create_neighbor_entry_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk remove neighbor entry
+ *
+ * @param[in] object_count Number of objects to remove
+ * @param[in] neighbor_entry List of objects to remove
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_remove_neighbor_entry_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk set attribute on neighbor entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] neighbor_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are updated or
+ * #SAI_STATUS_FAILURE when any of the objects fails to update. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_neighbor_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on neighbor entry
+ *
+ * @param[in] object_count Number of objects to get attribute
+ * @param[in] neighbor_entry List of objects to get attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to get on objects
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are retrieved or
+ * #SAI_STATUS_FAILURE when any of the objects fails to retrieve. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_neighbor_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Remove all neighbor entries matching a filter
+ *
+ * Matching entries are removed in a single walk of the neighbor table. An
+ * entry matches when it is on rif_id (or rif_id is SAI_NULL_OBJECT_ID) and
+ * its IP address is covered by prefix (or prefix is NULL). A prefix of
+ * length 0 (0.0.0.0/0 or ::/0) matches one address family.
+ *
+ * Removed entries are returned in neighbor_entry_list. If neighbor_entry_list
+ * is not large enough to hold all matching entries, no entry is removed,
+ * neighbor_entry_count is set to the number of matching entries and
+ * #SAI_STATUS_BUFFER_OVERFLOW is returned. If neighbor_entry_list is NULL,
+ * matching entries are removed without being returned.
+ *
+ * Note: IP prefix/mask expected in Network Byte Order.
+ *
+ * @param[in] switch_id Switch id
+ * @param[in] rif_id Router interface id, or SAI_NULL_OBJECT_ID for any
+ * @param[in] prefix Covering prefix, or NULL for any
+ * @param[inout] neighbor_entry_count Size of neighbor_entry_list on input,
+ * number of removed entries on output
+ * @param[out] neighbor_entry_list List of removed neighbor entries
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_BUFFER_OVERFLOW if list
+ * size insufficient, failure status code on error
+ */
+typedef sai_status_t (*sai_remove_all_neighbor_entries_ext_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t rif_id,
+        _In_ const sai_ip_prefix_t *prefix,
+        _Inout_ uint32_t *neighbor_entry_count,
+        _Out_ sai_neighbor_entry_t *neighbor_entry_list);
+
 /**
  * @brief Neighbor table methods, retrieved via sai_api_query()
  */
 typedef struct _sai_neighbor_api_t
 {
-    sai_create_neighbor_entry_fn        create_neighbor_entry;
-    sai_remove_neighbor_entry_fn        remove_neighbor_entry;
-    sai_set_neighbor_entry_attribute_fn set_neighbor_entry_attribute;
-    sai_get_neighbor_entry_attribute_fn get_neighbor_entry_attribute;
-    sai_remove_all_neighbor_entries_fn  remove_all_neighbor_entries;
+    sai_create_neighbor_entry_fn             create_neighbor_entry;
+    sai_remove_neighbor_entry_fn             remove_neighbor_entry;
+    sai_set_neighbor_entry_attribute_fn      set_neighbor_entry_attribute;
+    sai_get_neighbor_entry_attribute_fn      get_neighbor_entry_attribute;
+    sai_remove_all_neighbor_entries_fn       remove_all_neighbor_entries;
+    sai_remove_all_neighbor_entries_ext_fn   remove_all_neighbor_entries_ext;
+
+    sai_bulk_create_neighbor_entry_fn        create_neighbor_entries;
+    sai_bulk_remove_neighbor_entry_fn        remove_neighbor_entries;
+    sai_bulk_set_neighbor_entry_attribute_fn set_neighbor_entries_attribute;
+    sai_bulk_get_neighbor_entry_attribute_fn get_neighbor_entries_attribute;
 
 } sai_neighbor_api_t;
 
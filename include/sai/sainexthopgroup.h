@@ -44,6 +44,19 @@ typedef enum _sai_next_hop_group_type_t
     /** Next hop protection group. Contains primary and backup next hops. */
     SAI_NEXT_HOP_GROUP_TYPE_PROTECTION,
 
+    /**
+     * @brief Next hop group is resilient (fine grain) ECMP
+     *
+     * Flows are hashed into a fixed size table of buckets and every bucket
+     * points to one member. Buckets are assigned to members in proportion
+     * to the member weights with the smallest possible rounding error.
+     * On member removal only the buckets of the removed member are
+     * reassigned, and on member addition or weight change only as many
+     * buckets as needed to restore the proportions are moved, so flows
+     * hashed to other buckets keep their next hop.
+     */
+    SAI_NEXT_HOP_GROUP_TYPE_FINE_GRAIN_ECMP,
+
     /* Other types of next hop group to be defined in the future, e.g., WCMP */
 
 } sai_next_hop_group_type_t;
@@ -113,6 +126,10 @@ typedef enum _sai_next_hop_group_attr_t
     /**
      * @brief Trigger a switch-over from primary to backup next hop
      *
+     * Routes and other objects point to the protection group and not to its
+     * members, so a switch-over is a single update of the group regardless
+     * of the number of routes using it.
+     *
      * @type bool
      * @flags CREATE_AND_SET
      * @default false
@@ -133,6 +150,82 @@ typedef enum _sai_next_hop_group_attr_t
      */
     SAI_NEXT_HOP_GROUP_ATTR_COUNTER_ID,
 
+    /**
+     * @brief Allow sharing of the hardware group with other next hop groups
+     *
+     * When enabled, adapter keys the hardware group by the (next hop, weight)
+     * multiset of its members, and next hop groups with equal member sets
+     * which both have sharing enabled are backed by a single reference counted
+     * hardware group. A shared hardware group only consumes one
+     * #SAI_SWITCH_ATTR_AVAILABLE_NEXT_HOP_GROUP_ENTRY. When the member set of
+     * one of the sharing groups is changed, adapter moves that group to a
+     * hardware group matching its new member set (copy on write), so sharing
+     * is not visible through any other attribute or API.
+     *
+     * A group with a non null #SAI_NEXT_HOP_GROUP_ATTR_COUNTER_ID is never
+     * shared, so that its counter only counts its own traffic. Attaching a
+     * counter to a shared group moves that group to its own hardware group
+     * (copy on write), and detaching it makes the group eligible for
+     * sharing again.
+     *
+     * @type bool
+     * @flags CREATE_ONLY
+     * @default false
+     * @validonly SAI_NEXT_HOP_GROUP_ATTR_TYPE == SAI_NEXT_HOP_GROUP_TYPE_ECMP
+     */
+    SAI_NEXT_HOP_GROUP_ATTR_SHARING_ENABLE,
+
+    /**
+     * @brief Number of next hop groups sharing the hardware group of this group
+     *
+     * Includes this group. Always 1 when sharing is disabled.
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_NEXT_HOP_GROUP_ATTR_SHARED_COUNT,
+
+    /**
+     * @brief Configured number of buckets of fine grain ECMP group
+     *
+     * Adapter may round the size up to a size supported by the hardware,
+     * see #SAI_NEXT_HOP_GROUP_ATTR_REAL_SIZE. The bucket table is accounted
+     * against #SAI_SWITCH_ATTR_ECMP_MEMBERS regardless of the number of
+     * members and their weights.
+     *
+     * @type sai_uint32_t
+     * @flags MANDATORY_ON_CREATE | CREATE_ONLY
+     * @condition SAI_NEXT_HOP_GROUP_ATTR_TYPE == SAI_NEXT_HOP_GROUP_TYPE_FINE_GRAIN_ECMP
+     */
+    SAI_NEXT_HOP_GROUP_ATTR_CONFIGURED_SIZE,
+
+    /**
+     * @brief Number of buckets of fine grain ECMP group in hardware
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_NEXT_HOP_GROUP_ATTR_REAL_SIZE,
+
+    /**
+     * @brief Switch over automatically on failure of a monitored object
+     *
+     * When enabled, failure of the object monitored by the active member
+     * (#SAI_NEXT_HOP_GROUP_MEMBER_ATTR_MONITORED_OBJECT) switches the group
+     * over to the standby member without a call from the application. On
+     * hardware which can not track the monitored object itself, adapter
+     * performs the switch-over when it processes the port operational status
+     * change, before #SAI_SWITCH_ATTR_PORT_STATE_CHANGE_NOTIFY is invoked.
+     * When disabled, switch-over is done only using
+     * #SAI_NEXT_HOP_GROUP_ATTR_SET_SWITCHOVER.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default true
+     * @validonly SAI_NEXT_HOP_GROUP_ATTR_TYPE == SAI_NEXT_HOP_GROUP_TYPE_PROTECTION
+     */
+    SAI_NEXT_HOP_GROUP_ATTR_AUTO_SWITCHOVER,
+
     /**
      * @brief End of attributes
      */
@@ -205,11 +298,14 @@ typedef enum _sai_next_hop_group_member_attr_t
      * @brief The object to be monitored for this next hop.
      *
      * If the specified objects fails, the switching entity marks this
-     * next hop as SAI_NEXT_HOP_GROUP_MEMBER_PROTECTION_ROLE_FAILED and does
+     * next hop as SAI_NEXT_HOP_GROUP_MEMBER_OBSERVED_ROLE_INACTIVE and does
      * not use it to forward traffic. If there is a backup next hop available
      * in this group then the backup's observed role is set to
-     * SAI_NEXT_HOP_GROUP_MEMBER_PROTECTION_ROLE_FORWARDING and it is used to
-     * forward traffic.
+     * SAI_NEXT_HOP_GROUP_MEMBER_OBSERVED_ROLE_ACTIVE and it is used to
+     * forward traffic. See #SAI_NEXT_HOP_GROUP_ATTR_AUTO_SWITCHOVER.
+     *
+     * Supported object types are reported by
+     * #SAI_SWITCH_ATTR_SUPPORTED_PROTECTED_OBJECT_TYPE.
      *
      * @type sai_object_id_t
      * @flags CREATE_AND_SET
@@ -219,6 +315,16 @@ typedef enum _sai_next_hop_group_member_attr_t
      */
     SAI_NEXT_HOP_GROUP_MEMBER_ATTR_MONITORED_OBJECT,
 
+    /**
+     * @brief Number of buckets assigned to the member
+     *
+     * Only valid if the type of owning group is SAI_NEXT_HOP_GROUP_TYPE_FINE_GRAIN_ECMP
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_BUCKET_COUNT,
+
     /**
      * @brief End of attributes
      */
@@ -336,6 +442,44 @@ typedef sai_status_t (*sai_get_next_hop_group_member_attribute_fn)(
         _In_ uint32_t attr_count,
         _Inout_ sai_attribute_t *attr_list);
 
+/**
+ * @brief Replace the complete member set of next hop group
+ *
+ * The given list describes the desired member set of the group. Adapter
+ * computes the difference to the current member set and applies it to
+ * hardware as a single update, so that the group never forwards using an
+ * intermediate member set. Members whose next hop is in both sets keep their
+ * member object id, only their weight is updated if it differs. Members whose
+ * next hop is not in the list are removed, and member objects are created for
+ * the remaining next hops. Flows hashed to unchanged members are not remapped
+ * where the hardware allows it.
+ *
+ * An empty list removes all members of the group. Each next hop may appear
+ * only once in the list.
+ *
+ * Only groups of type #SAI_NEXT_HOP_GROUP_TYPE_ECMP and
+ * #SAI_NEXT_HOP_GROUP_TYPE_FINE_GRAIN_ECMP are accepted. Other group types,
+ * whose members carry attributes such as
+ * #SAI_NEXT_HOP_GROUP_MEMBER_ATTR_CONFIGURED_ROLE that can not be passed
+ * here, return #SAI_STATUS_NOT_SUPPORTED.
+ *
+ * @param[in] next_hop_group_id Next hop group id
+ * @param[in] next_hop_count Number of next hops in the desired member set
+ * @param[in] next_hop_id List of next hop ids
+ * @param[in] weight List of member weights, or NULL for weight 1 for every member
+ * @param[out] next_hop_group_member_id List of member ids, one for every
+ * next hop id in the list. Caller needs to allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error. On
+ * failure the member set of the group is left unchanged.
+ */
+typedef sai_status_t (*sai_replace_next_hop_group_members_fn)(
+        _In_ sai_object_id_t next_hop_group_id,
+        _In_ uint32_t next_hop_count,
+        _In_ const sai_object_id_t *next_hop_id,
+        _In_ const uint32_t *weight,
+        _Out_ sai_object_id_t *next_hop_group_member_id);
+
 /**
  * @brief Next Hop methods table retrieved with sai_api_query()
  */
@@ -351,6 +495,7 @@ typedef struct _sai_next_hop_group_api_t
     sai_get_next_hop_group_member_attribute_fn get_next_hop_group_member_attribute;
     sai_bulk_object_create_fn                  create_next_hop_group_members;
     sai_bulk_object_remove_fn                  remove_next_hop_group_members;
+    sai_replace_next_hop_group_members_fn      replace_next_hop_group_members;
 } sai_next_hop_group_api_t;
 
 /**
@@ -42,6 +42,17 @@
  */
 
 /**
+ * @brief Object key entry
+ *
+ * Non object id keys (route, neighbor, FDB, NAT, inseg, ...) contain implicit
+ * structure padding and address unions wider than the value they carry.
+ * Keys returned by the adapter (for example by sai_get_object_key() and in
+ * notifications) are zero filled before being populated and carry IP
+ * prefixes in canonical form (see sai_ip_prefix_t), so that the caller can
+ * hash, compare and order them as raw memory of sizeof(key). Callers that
+ * want the same property for keys they build themselves should zero
+ * initialize the key before setting individual fields.
+ *
  * @extraparam sai_object_type_t object_type
  */
 typedef union _sai_object_key_entry_t
@@ -199,6 +210,35 @@ sai_status_t sai_bulk_get_attribute(
         _Inout_ sai_attribute_t **attr_list,
         _Inout_ sai_status_t *object_statuses);
 
+/**
+ * @brief Get a consistent snapshot of counters of multiple objects
+ *
+ * All requested counters are latched from HW as close to simultaneously
+ * as the NPU allows, bypassing the SW counter cache, so that counters of
+ * different objects (e.g. ingress and egress ports, a port and its queues)
+ * can be reconciled. Entry i reads counter_ids[i] of object_id[i]; counter
+ * ids are interpreted according to the object type of the object.
+ *
+ * @param[in] switch_id SAI Switch object id
+ * @param[in] entry_count Number of (object, counter) pairs
+ * @param[in] object_id List of object ids
+ * @param[in] counter_ids List of counter ids
+ * @param[out] counters Array of resulting counter values
+ * @param[out] timestamp Capture time, midpoint of the latch window
+ * @param[out] skew Upper bound in nanoseconds between the earliest and
+ *    the latest latched counter
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+sai_status_t sai_get_stats_snapshot(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t entry_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_stat_id_t *counter_ids,
+        _Out_ uint64_t *counters,
+        _Out_ sai_timespec_t *timestamp,
+        _Out_ uint64_t *skew);
+
 /**
  * @brief Query attribute capability
  *
@@ -128,6 +128,28 @@ typedef enum _sai_route_entry_attr_t
      */
     SAI_ROUTE_ENTRY_ATTR_COUNTER_ID,
 
+    /**
+     * @brief Route entry hit bit clear on read flag
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_ROUTE_ENTRY_ATTR_HIT_BIT_COR,
+
+    /**
+     * @brief Per route entry hit bit state
+     *
+     * Set by hardware when a packet is forwarded using this route entry.
+     * Can be cleared by setting it to false, or on read when
+     * #SAI_ROUTE_ENTRY_ATTR_HIT_BIT_COR is set.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_ROUTE_ENTRY_ATTR_HIT_BIT,
+
     /**
      * @brief End of attributes
      */
@@ -313,6 +335,67 @@ typedef sai_status_t (*sai_bulk_get_route_entry_attribute_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk get hit bit state of route entries
+ *
+ * Reads the hardware hit bit (#SAI_ROUTE_ENTRY_ATTR_HIT_BIT) of every route
+ * entry in the list in a single table pass and returns them as a packed
+ * bitmap, without going through the generic attribute path for each entry.
+ * Intended for software aging of host routes.
+ *
+ * Hit state of route_entry[i] is returned in bit (i % 8) of
+ * hit_bitmap[i / 8]. Bits of entries that failed are set to 0.
+ *
+ * The clear_on_read argument takes precedence over
+ * #SAI_ROUTE_ENTRY_ATTR_HIT_BIT_COR of the entries, which only applies to
+ * reads of #SAI_ROUTE_ENTRY_ATTR_HIT_BIT through get attribute calls: hit
+ * bits are cleared if and only if clear_on_read is true.
+ *
+ * @param[in] object_count Number of objects to query
+ * @param[in] route_entry List of objects to query
+ * @param[in] clear_on_read Clear hit bit of every queried entry after reading it
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] hit_bitmap Packed hit bitmap. Caller needs to allocate
+ * (object_count + 7) / 8 bytes
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when hit state of all objects is
+ * returned or #SAI_STATUS_FAILURE when any of the objects fails. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_route_entry_hit_bit_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ bool clear_on_read,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ uint8_t *hit_bitmap,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Remove all route entries of a virtual router
+ *
+ * Removes every route entry in vr_id whose destination is covered by prefix,
+ * walking the route table once inside the adapter. A prefix of length 0
+ * (0.0.0.0/0 or ::/0) limits the removal to one address family, and a NULL
+ * prefix removes all IPv4 and IPv6 route entries of the virtual router.
+ *
+ * Note: IP prefix/mask expected in Network Byte Order.
+ *
+ * @param[in] switch_id Switch id
+ * @param[in] vr_id Virtual router id
+ * @param[in] prefix Covering prefix, or NULL for all route entries
+ * @param[out] removed_count Number of route entries removed
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+typedef sai_status_t (*sai_remove_all_route_entries_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t vr_id,
+        _In_ const sai_ip_prefix_t *prefix,
+        _Out_ uint32_t *removed_count);
+
 /**
  * @brief Router entry methods table retrieved with sai_api_query()
  */
@@ -328,6 +411,9 @@ typedef struct _sai_route_api_t
     sai_bulk_set_route_entry_attribute_fn       set_route_entries_attribute;
     sai_bulk_get_route_entry_attribute_fn       get_route_entries_attribute;
 
+    sai_bulk_get_route_entry_hit_bit_fn         get_route_entries_hit_bit;
+    sai_remove_all_route_entries_fn             remove_all_route_entries;
+
 } sai_route_api_t;
 
 /**
@@ -242,6 +242,169 @@ typedef enum _sai_switch_mcast_snooping_capability_t
 
 } sai_switch_mcast_snooping_capability_t;
 
+/**
+ * @brief Attribute data for #SAI_SWITCH_ATTR_FDB_AGING_MODE
+ */
+typedef enum _sai_switch_fdb_aging_mode_t
+{
+    /** Dynamic FDB entries are aged by the hardware table scan */
+    SAI_SWITCH_FDB_AGING_MODE_HARDWARE,
+
+    /** Dynamic FDB entries are aged by the adapter software aging engine */
+    SAI_SWITCH_FDB_AGING_MODE_SOFTWARE,
+
+} sai_switch_fdb_aging_mode_t;
+
+/**
+ * @brief Attribute data for #SAI_SWITCH_ATTR_PFC_DLD_MODE
+ */
+typedef enum _sai_switch_pfc_dld_mode_t
+{
+    /** PFC deadlock detection and recovery by the hardware */
+    SAI_SWITCH_PFC_DLD_MODE_HARDWARE,
+
+    /** PFC deadlock detection and recovery by the adapter software watchdog */
+    SAI_SWITCH_PFC_DLD_MODE_SOFTWARE,
+
+} sai_switch_pfc_dld_mode_t;
+
+/**
+ * @brief Attribute data for #SAI_SWITCH_ATTR_NOTIFICATION_DELIVERY_MODE
+ */
+typedef enum _sai_switch_notification_delivery_mode_t
+{
+    /** Notifications are delivered by calling the registered callbacks */
+    SAI_SWITCH_NOTIFICATION_DELIVERY_MODE_CALLBACK,
+
+    /** Notifications are written to per type shared memory rings */
+    SAI_SWITCH_NOTIFICATION_DELIVERY_MODE_SHARED_MEMORY_RING,
+
+} sai_switch_notification_delivery_mode_t;
+
+/**
+ * @brief Notification types which can be delivered through a shared memory ring
+ */
+typedef enum _sai_switch_notification_type_t
+{
+    /** Payload is an array of sai_fdb_event_notification_data_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT,
+
+    /** Payload is an array of sai_port_oper_status_notification_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE,
+
+    /** Payload is sai_switch_notification_ring_buffer_event_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_PACKET_EVENT,
+
+    /** Payload is an array of sai_queue_deadlock_notification_data_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK,
+
+    /** Payload is an array of sai_bfd_session_state_notification_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE,
+
+    /** Payload is sai_switch_notification_ring_buffer_event_t */
+    SAI_SWITCH_NOTIFICATION_TYPE_TAM_EVENT,
+
+} sai_switch_notification_type_t;
+
+/**
+ * @def SAI_SWITCH_NOTIFICATION_RING_HEADER_SIZE
+ * Size of the ring header in bytes. Records start at this offset.
+ */
+#define SAI_SWITCH_NOTIFICATION_RING_HEADER_SIZE 256
+
+/**
+ * @brief Header at the start of notification shared memory ring
+ *
+ * The ring is single producer (adapter) single consumer. The adapter writes
+ * record number (head % record_count), then advances head with release
+ * semantics. The consumer reads records from tail up to head, then advances
+ * tail with release semantics. Head and tail only ever increase and are kept
+ * in separate cache lines. When the ring is full, new notifications are
+ * counted in dropped and discarded.
+ */
+typedef struct _sai_switch_notification_ring_header_t
+{
+    /** Size of one record in bytes, including sai_switch_notification_ring_record_t */
+    uint32_t record_size;
+
+    /** Number of records in the ring, power of two */
+    uint32_t record_count;
+
+    /**
+     * @brief Number of notification data elements dropped
+     *
+     * Counts elements dropped because the ring was full or because they did
+     * not fit in a single record.
+     */
+    uint64_t dropped;
+
+    /** Reserved, pads head to its own cache line */
+    uint8_t reserved0[48];
+
+    /** Producer index, written by adapter only */
+    uint64_t head;
+
+    /** Reserved, pads tail to its own cache line */
+    uint8_t reserved1[56];
+
+    /** Consumer index, written by consumer only */
+    uint64_t tail;
+
+    /** Reserved, pads the header to #SAI_SWITCH_NOTIFICATION_RING_HEADER_SIZE */
+    uint8_t reserved2[120];
+
+} sai_switch_notification_ring_header_t;
+
+/**
+ * @brief Header of one notification ring record
+ *
+ * The payload immediately follows the record header. It has the format of
+ * the data argument of the corresponding callback, with every pointer member
+ * set to NULL and the pointed data stored inline after the array, in array
+ * order (e.g. attr of every sai_fdb_event_notification_data_t). Records never
+ * reference data outside of themselves.
+ */
+typedef struct _sai_switch_notification_ring_record_t
+{
+    /** Time the notification was generated */
+    sai_timespec_t timestamp;
+
+    /** Number of notification data elements in the payload */
+    uint32_t count;
+
+    /** Size of the payload in bytes */
+    uint32_t length;
+
+} sai_switch_notification_ring_record_t;
+
+/**
+ * @brief Payload of packet event and TAM event ring record
+ *
+ * Followed by attr_count attributes and then by buffer_size bytes of buffer.
+ * Buffer is truncated to fit the record, in which case truncated is set. The
+ * record size of the packet and TAM event rings is configured separately
+ * from the other rings with #SAI_SWITCH_ATTR_NOTIFICATION_RING_RECORD_SIZE,
+ * so that it can be sized for the largest expected buffer.
+ */
+typedef struct _sai_switch_notification_ring_buffer_event_t
+{
+    /** Switch id for packet event, TAM event id for TAM event */
+    sai_object_id_t object_id;
+
+    /** Original buffer size */
+    uint32_t original_size;
+
+    /** Number of buffer bytes stored in the record */
+    uint32_t buffer_size;
+
+    /** Number of attributes */
+    uint32_t attr_count;
+
+    /** Buffer was truncated */
+    bool truncated;
+
+} sai_switch_notification_ring_buffer_event_t;
+
 /**
  * @brief Attribute Id in sai_set_switch_attribute() and
  * sai_get_switch_attribute() calls
@@ -1838,6 +2001,320 @@ typedef enum _sai_switch_attr_t
      */
     SAI_SWITCH_ATTR_SUPPORTED_OBJECT_TYPE_LIST,
 
+    /**
+     * @brief FDB event notification coalescing interval in microseconds
+     *
+     * FDB events are collected for at most this amount of time, or until
+     * #SAI_SWITCH_ATTR_FDB_EVENT_COALESCE_MAX_COUNT events are collected,
+     * and then delivered in a single call of sai_fdb_event_notification_fn.
+     * Events for the same FDB entry within one window are reduced to the net
+     * change against the state last reported to the application, e.g.
+     * LEARNED followed by MOVE is reported as LEARNED on the final bridge
+     * port, LEARNED followed by AGED is not reported at all, and several
+     * MOVE events are reported as a single MOVE.
+     *
+     * Zero disables coalescing.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_SWITCH_ATTR_FDB_EVENT_COALESCE_INTERVAL,
+
+    /**
+     * @brief Maximum number of FDB events delivered in one notification
+     *
+     * Only effective when #SAI_SWITCH_ATTR_FDB_EVENT_COALESCE_INTERVAL is
+     * non zero. Zero means no limit other than the coalescing interval.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_SWITCH_ATTR_FDB_EVENT_COALESCE_MAX_COUNT,
+
+    /**
+     * @brief Notification delivery mode
+     *
+     * In shared memory ring mode, FDB event, port state change, packet event,
+     * queue PFC deadlock, BFD session state change and TAM event notifications
+     * are written to one shared memory ring per notification type instead of
+     * invoking the callbacks, so that a consumer in another process can read
+     * them without a copy or context switch per notification. The rings are
+     * POSIX shared memory objects named by
+     * #SAI_SWITCH_ATTR_NOTIFICATION_RING_NAME_PREFIX followed by the decimal
+     * sai_switch_notification_type_t value, starting with
+     * sai_switch_notification_ring_header_t. Since there is no return path,
+     * PFC deadlock recovery is always managed by the adapter in this mode.
+     *
+     * @type sai_switch_notification_delivery_mode_t
+     * @flags CREATE_ONLY
+     * @default SAI_SWITCH_NOTIFICATION_DELIVERY_MODE_CALLBACK
+     */
+    SAI_SWITCH_ATTR_NOTIFICATION_DELIVERY_MODE,
+
+    /**
+     * @brief Name prefix of notification shared memory rings
+     *
+     * String is NULL terminated.
+     *
+     * @type sai_s8_list_t
+     * @flags MANDATORY_ON_CREATE | CREATE_ONLY
+     * @condition SAI_SWITCH_ATTR_NOTIFICATION_DELIVERY_MODE == SAI_SWITCH_NOTIFICATION_DELIVERY_MODE_SHARED_MEMORY_RING
+     */
+    SAI_SWITCH_ATTR_NOTIFICATION_RING_NAME_PREFIX,
+
+    /**
+     * @brief Number of records in every notification ring
+     *
+     * Must be a power of two.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_ONLY
+     * @default 4096
+     */
+    SAI_SWITCH_ATTR_NOTIFICATION_RING_RECORD_COUNT,
+
+    /**
+     * @brief Size of notification ring records in bytes
+     *
+     * Key is sai_switch_notification_type_t and value is the record size of
+     * that ring. Rings not in the map use records of 512 bytes, except the
+     * packet event ring which uses records of 10240 bytes so that trapped
+     * control plane packets up to jumbo size are received whole.
+     *
+     * Notifications larger than the record are split over several records,
+     * except for packet and TAM events whose buffer is truncated. Splitting
+     * only happens at data element boundaries, so every record is a
+     * standalone batch of the callback data. A single element larger than
+     * record size minus sizeof(sai_switch_notification_ring_record_t) is
+     * discarded and counted in dropped of the ring header.
+     *
+     * @type sai_map_list_t
+     * @flags CREATE_ONLY
+     * @default empty
+     */
+    SAI_SWITCH_ATTR_NOTIFICATION_RING_RECORD_SIZE,
+
+    /**
+     * @brief Wake up event file descriptors of notification rings
+     *
+     * Key is sai_switch_notification_type_t and value is an eventfd which the
+     * adapter signals after publishing one or more records to the ring. The
+     * descriptors can be passed to the consumer process over a UNIX domain
+     * socket.
+     *
+     * @type sai_map_list_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_NOTIFICATION_RING_EVENTFD,
+
+    /**
+     * @brief Number of hash buckets of the FDB table
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_FDB_HASH_BUCKET_COUNT,
+
+    /**
+     * @brief Number of entries in one hash bucket of the FDB table
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_FDB_HASH_BUCKET_SIZE,
+
+    /**
+     * @brief FDB table hash bucket occupancy histogram
+     *
+     * Element i of the list is the number of hash buckets holding i entries,
+     * for i from 0 to #SAI_SWITCH_ATTR_FDB_HASH_BUCKET_SIZE.
+     *
+     * @type sai_u32_list_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_FDB_HASH_BUCKET_OCCUPANCY,
+
+    /**
+     * @brief Dynamic FDB entry aging mode
+     *
+     * In software mode hardware aging is disabled and every dynamic FDB
+     * entry, whether learned or created by the application, is tracked by a
+     * hierarchical timer wheel in the adapter, so that the cost per tick is
+     * proportional to the number of entries expiring and not to the table
+     * size. Hit bits of expiring entries are read in batches. Entries that
+     * were hit are rescheduled, the others are removed and reported with
+     * SAI_FDB_EVENT_AGED through #SAI_SWITCH_ATTR_FDB_EVENT_NOTIFY. Whether
+     * an entry ages is taken from #SAI_FDB_ENTRY_ATTR_AGING, or else from
+     * #SAI_BRIDGE_PORT_ATTR_FDB_AGING_ENABLE of the entry bridge port. Aging
+     * time is taken from #SAI_FDB_ENTRY_ATTR_AGING_TIME, or else from
+     * #SAI_BRIDGE_PORT_ATTR_FDB_AGING_TIME of the entry bridge port, or else
+     * from #SAI_SWITCH_ATTR_FDB_AGING_TIME, the first non zero value applies.
+     *
+     * @type sai_switch_fdb_aging_mode_t
+     * @flags CREATE_AND_SET
+     * @default SAI_SWITCH_FDB_AGING_MODE_HARDWARE
+     */
+    SAI_SWITCH_ATTR_FDB_AGING_MODE,
+
+    /**
+     * @brief Enable MAC move dampening
+     *
+     * Adapter keeps a move penalty for every FDB entry which has moved
+     * recently. Every move adds #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_PENALTY
+     * and the penalty decays exponentially with
+     * #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_HALF_LIFE. While an entry is
+     * suppressed its move events are not reported and
+     * #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_PACKET_ACTION is applied to the
+     * entry. The move state of an entry which is not suppressed is discarded
+     * once its penalty decays below half of
+     * #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_REUSE_THRESHOLD, so state is only
+     * kept for MAC addresses which moved within a few half lives and the
+     * cost is bounded by the number of moving MAC addresses.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_ENABLE,
+
+    /**
+     * @brief Penalty added to FDB entry for every move
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 1000
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_PENALTY,
+
+    /**
+     * @brief Half life of FDB entry move penalty in milliseconds
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 15000
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_HALF_LIFE,
+
+    /**
+     * @brief Move penalty above which the FDB entry is suppressed
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 5000
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_SUPPRESS_THRESHOLD,
+
+    /**
+     * @brief Move penalty below which suppressed FDB entry is reused
+     *
+     * Must be lower than #SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_SUPPRESS_THRESHOLD,
+     * setting either attribute so that reuse threshold is greater than or
+     * equal to suppress threshold fails with #SAI_STATUS_INVALID_ATTR_VALUE.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 2000
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_REUSE_THRESHOLD,
+
+    /**
+     * @brief Packet action for suppressed FDB entries
+     *
+     * SAI_PACKET_ACTION_FORWARD keeps forwarding to the last learned bridge
+     * port and only suppresses the notifications.
+     *
+     * @type sai_packet_action_t
+     * @flags CREATE_AND_SET
+     * @default SAI_PACKET_ACTION_FORWARD
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_PACKET_ACTION,
+
+    /**
+     * @brief FDB table generation number
+     *
+     * Incremented on every change of the FDB table, including learning,
+     * aging and moves.
+     *
+     * @type sai_uint64_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_FDB_GENERATION,
+
+    /**
+     * @brief Maintain per counter rates in the SW counter cache
+     *
+     * Rates are updated on every cache refresh and read with
+     * #SAI_STATS_MODE_READ_RATE. Only valid with a non zero
+     * #SAI_SWITCH_ATTR_COUNTER_REFRESH_INTERVAL.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_SWITCH_ATTR_COUNTER_RATE_ENABLE,
+
+    /**
+     * @brief EWMA time constants in milliseconds for counter rates
+     *
+     * Up to three entries, read with #SAI_STATS_MODE_READ_EWMA_0 to
+     * #SAI_STATS_MODE_READ_EWMA_2 respectively, e.g. 1000, 10000, 60000.
+     * Empty list disables EWMA computation.
+     *
+     * @type sai_u32_list_t
+     * @flags CREATE_AND_SET
+     * @default empty
+     * @validonly SAI_SWITCH_ATTR_COUNTER_RATE_ENABLE == true
+     */
+    SAI_SWITCH_ATTR_COUNTER_EWMA_INTERVAL_LIST,
+
+    /**
+     * @brief PFC deadlock detection mode
+     *
+     * In software mode the adapter polls, for all queues with
+     * #SAI_QUEUE_ATTR_ENABLE_PFC_DLDR set, the PFC pause RX counter of the
+     * queue priority on the port and the queue TX and occupancy counters in
+     * bulk every #SAI_SWITCH_ATTR_PFC_DLD_POLL_INTERVAL. A queue which keeps
+     * receiving pause frames and has a non zero occupancy without
+     * transmitting for #SAI_SWITCH_ATTR_PFC_TC_DLD_INTERVAL is considered
+     * deadlocked. Recovery, #SAI_SWITCH_ATTR_PFC_DLR_PACKET_ACTION,
+     * #SAI_SWITCH_ATTR_PFC_TC_DLR_INTERVAL and the
+     * #SAI_SWITCH_ATTR_QUEUE_PFC_DEADLOCK_NOTIFY notification behave as in
+     * hardware mode.
+     *
+     * @type sai_switch_pfc_dld_mode_t
+     * @flags CREATE_AND_SET
+     * @default SAI_SWITCH_PFC_DLD_MODE_HARDWARE
+     */
+    SAI_SWITCH_ATTR_PFC_DLD_MODE,
+
+    /**
+     * @brief Software PFC deadlock detection poll interval in milliseconds
+     *
+     * Detection and recovery intervals are rounded up to a multiple of the
+     * poll interval.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 10
+     * @validonly SAI_SWITCH_ATTR_PFC_DLD_MODE == SAI_SWITCH_PFC_DLD_MODE_SOFTWARE
+     */
+    SAI_SWITCH_ATTR_PFC_DLD_POLL_INTERVAL,
+
+    /**
+     * @brief Maximum time in milliseconds an FDB entry stays suppressed
+     *
+     * The move penalty is capped at reuse threshold * 2^(max suppress time /
+     * half life), so that once the entry stops moving it is reused after at
+     * most this time, however long it kept moving before.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 60000
+     */
+    SAI_SWITCH_ATTR_FDB_MOVE_DAMPENING_MAX_SUPPRESS_TIME,
+
     /**
      * @brief End of attributes
      */
@@ -36,6 +36,28 @@ typedef enum _sai_switch_attr_extensions_t
 {
     SAI_SWITCH_ATTR_EXTENSIONS_RANGE_START = SAI_SWITCH_ATTR_END,
 
+    /**
+     * @brief Memory budget in bytes for the counter history
+     *
+     * Shared by the counter history of all counter refresh groups, see
+     * #SAI_COUNTER_REFRESH_GROUP_ATTR_HISTORY_DURATION. When the budget is
+     * exhausted the oldest samples are discarded before the configured
+     * history duration is reached.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 67108864
+     */
+    SAI_SWITCH_ATTR_COUNTER_HISTORY_MEMORY_SIZE = SAI_SWITCH_ATTR_EXTENSIONS_RANGE_START,
+
+    /**
+     * @brief Memory in bytes used by the counter history
+     *
+     * @type sai_uint64_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_COUNTER_HISTORY_MEMORY_USED,
+
     SAI_SWITCH_ATTR_EXTENSIONS_RANGE_END
 
 } sai_switch_attr_extensions_t;
@@ -366,6 +366,15 @@ typedef struct _sai_ip_address_list_t
     sai_ip_address_t *list;
 } sai_ip_address_list_t;
 
+/**
+ * @brief IP prefix
+ *
+ * The prefix is in canonical form when addr has no bits set outside of mask
+ * and, for IPv4, the unused trailing bytes of both addr and mask unions are
+ * zero. Two canonical prefixes are equal if and only if they are equal
+ * byte-wise, which allows entries keyed on a prefix to be hashed and compared
+ * as a fixed size block instead of field by field.
+ */
 typedef struct _sai_ip_prefix_t
 {
     sai_ip_addr_family_t addr_family;
@@ -1138,6 +1147,39 @@ typedef enum _sai_stats_mode_t
      * @brief Read and clear after reading
      */
     SAI_STATS_MODE_READ_AND_CLEAR,
+
+    /**
+     * @brief Read rate per second
+     *
+     * Counter change per second over the last SW counter cache refresh
+     * interval. Requires #SAI_SWITCH_ATTR_COUNTER_RATE_ENABLE.
+     *
+     * Rates are returned in fixed point as thousandths of a counter unit
+     * per second, e.g. 1500 for 1.5 packets per second, so that rates of
+     * slowly changing counters such as error counters do not read as 0.
+     */
+    SAI_STATS_MODE_READ_RATE,
+
+    /**
+     * @brief Read rate per second averaged over the first EWMA interval
+     *
+     * Exponentially weighted moving average of #SAI_STATS_MODE_READ_RATE
+     * with time constant from entry 0 of
+     * #SAI_SWITCH_ATTR_COUNTER_EWMA_INTERVAL_LIST, in the same fixed point
+     * unit. The adapter keeps the average at higher precision internally
+     * and only rounds the returned value.
+     */
+    SAI_STATS_MODE_READ_EWMA_0,
+
+    /**
+     * @brief Read rate per second averaged over the second EWMA interval
+     */
+    SAI_STATS_MODE_READ_EWMA_1,
+
+    /**
+     * @brief Read rate per second averaged over the third EWMA interval
+     */
+    SAI_STATS_MODE_READ_EWMA_2,
 } sai_stats_mode_t;
 
 /**
@@ -42,6 +42,10 @@ typedef enum _sai_object_type_extensions_t
 
     SAI_OBJECT_TYPE_TABLE_META_TUNNEL_ENTRY,
 
+    SAI_OBJECT_TYPE_STATS_SUBSCRIPTION,
+
+    SAI_OBJECT_TYPE_COUNTER_REFRESH_GROUP,
+
     /* Add new experimental object types above this line */
 
     SAI_OBJECT_TYPE_EXTENSIONS_RANGE_END